@@ -12,15 +12,42 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <iomanip>
+#include <fstream>
+#include <cstdint>
+#include <array>
+#include <utility>
+#include <cstring>
+#include <climits>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define PREFETCH(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#elif defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define PREFETCH(addr) ((void)0)
+#endif
 
 int WINDOW_WIDTH = 1000;
 int WINDOW_HEIGHT = 700;
 int NUM_BARS = 100;
 float BASE_DELAY = 0.01f;
-float BAR_WIDTH = static_cast<float>(WINDOW_WIDTH) / NUM_BARS;
+const int CACHE_LINE_BYTES = 64;
+const int HEAP_ARITY = 4; // 16-byte sibling groups: aligned, each sits inside one cache line
 std::atomic<bool> isPaused(false);
 std::atomic<bool> isAborted(false);
 std::atomic<bool> stepMode(false);
+std::atomic<size_t> cacheLinesTouched(0); // child cache lines read by the heap sifts, see touchLines()
+std::atomic<int> charDepth(0); // byte position the string engines are currently working on
+std::atomic<bool> liveRunning(false);
 std::mutex dataMutex;
 std::condition_variable pauseCV;
 std::condition_variable stepCV;
@@ -36,6 +63,13 @@ void pauseCheck() {
     }
 }
 
+// Adds the number of distinct cache lines spanned by data[first..last], i.e. what one sift level reads
+inline void touchLines(const std::vector<int>& data, int first, int last) {
+    uintptr_t firstLine = reinterpret_cast<uintptr_t>(&data[first]) / CACHE_LINE_BYTES;
+    uintptr_t lastLine = reinterpret_cast<uintptr_t>(&data[last]) / CACHE_LINE_BYTES;
+    cacheLinesTouched += lastLine - firstLine + 1;
+}
+
 sf::Color getGradientColor(int value, int minVal, int maxVal) {
     if (minVal == maxVal) return sf::Color::White; // Avoid division by zero
     float t = static_cast<float>(value - minVal) / (maxVal - minVal);
@@ -50,11 +84,13 @@ void drawBars(sf::RenderWindow& window, const std::vector<int>& data, const std:
     int minVal = *std::min_element(data.begin(), data.end());
     int maxVal = *std::max_element(data.begin(), data.end());
 
+    // Width follows the data rather than NUM_BARS, since live updates grow and shrink the array
+    float barWidth = static_cast<float>(WINDOW_WIDTH) / data.size();
     for (size_t i = 0; i < data.size(); ++i) {
         sf::RectangleShape bar;
-        float width = std::max(1.0f, BAR_WIDTH - 1.0f);
+        float width = std::max(1.0f, barWidth - 1.0f);
         bar.setSize(sf::Vector2f(width, static_cast<float>(data[i])));
-        bar.setPosition(i * BAR_WIDTH, static_cast<float>(WINDOW_HEIGHT - data[i]));
+        bar.setPosition(i * barWidth, static_cast<float>(WINDOW_HEIGHT - data[i]));
 
         bool isHighlighted = std::find(highlightedIndices.begin(), highlightedIndices.end(), static_cast<int>(i)) != highlightedIndices.end();
         bar.setFillColor(isHighlighted ? sf::Color::White : getGradientColor(data[i], minVal, maxVal));
@@ -136,6 +172,134 @@ void insertionSortVisualized(std::vector<int>& data, float delay, std::vector<in
     }
 }
 
+// Sorting networks for 2..MAX_NETWORK_SIZE elements, generated at compile time with Batcher's odd-even
+// merge sort on the next power of two; comparators that touch a padding slot are dropped, since padding
+// would hold +infinity and never move. This is optimal up to 8 inputs and within a few comparators of
+// the best known networks above that (63 vs 60 at 16, 191 vs 185 at 32).
+const int MAX_NETWORK_SIZE = 32;
+const int MAX_NETWORK_COMPARATORS = 191;
+
+struct NetworkComparators {
+    int size;
+    unsigned char a[MAX_NETWORK_COMPARATORS];
+    unsigned char b[MAX_NETWORK_COMPARATORS];
+    constexpr NetworkComparators() : size(0), a{}, b{} {}
+};
+
+constexpr NetworkComparators makeNetwork(int n) {
+    NetworkComparators net;
+    int p2 = 1;
+    while (p2 < n) p2 <<= 1;
+    for (int p = 1; p < p2; p <<= 1)
+        for (int k = p; k >= 1; k >>= 1)
+            for (int j = k % p; j + k < p2; j += 2 * k)
+                for (int i = 0; i < k && i < p2 - j - k; ++i)
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p) && i + j + k < n) {
+                        net.a[net.size] = static_cast<unsigned char>(i + j);
+                        net.b[net.size] = static_cast<unsigned char>(i + j + k);
+                        net.size++;
+                    }
+    return net;
+}
+
+template<size_t... N>
+constexpr std::array<NetworkComparators, sizeof...(N)> makeNetworkTable(std::index_sequence<N...>) {
+    return { { makeNetwork(static_cast<int>(N))... } };
+}
+
+constexpr std::array<NetworkComparators, MAX_NETWORK_SIZE + 1> NETWORKS =
+    makeNetworkTable(std::make_index_sequence<MAX_NETWORK_SIZE + 1>());
+
+// Branchless: both selects compile to conditional moves, so random input costs no mispredictions
+inline void compareExchange(int& x, int& y) {
+    int a = x, b = y;
+    bool lt = a < b;
+    x = lt ? a : b;
+    y = lt ? b : a;
+}
+
+// Counting form for the engine leaves: adds 1 when the pair was out of order, still without a branch
+inline void compareExchange(int& x, int& y, size_t& exchanges) {
+    int a = x, b = y;
+    bool out = b < a;
+    x = out ? b : a;
+    y = out ? a : b;
+    exchanges += out;
+}
+
+// Fully unrolled with constant indices, so every element of v can stay in a register
+template<int N, int I, int Count>
+struct NetworkUnroll {
+    static void apply(int* v, size_t& exchanges) {
+        compareExchange(v[NETWORKS[N].a[I]], v[NETWORKS[N].b[I]], exchanges);
+        NetworkUnroll<N, I + 1, Count>::apply(v, exchanges);
+    }
+};
+
+template<int N, int Count>
+struct NetworkUnroll<N, Count, Count> {
+    static void apply(int*, size_t&) {}
+};
+
+// Sorts v[0..N) and adds the number of exchanges that moved something, for the engines' swap counter
+template<int N>
+void networkSort(int* v, size_t& exchanges) {
+    size_t local = 0;
+    NetworkUnroll<N, 0, NETWORKS[N].size>::apply(v, local);
+    exchanges += local;
+}
+
+typedef void (*NetworkSorter)(int*, size_t&);
+
+template<size_t... N>
+constexpr std::array<NetworkSorter, sizeof...(N)> makeNetworkSorters(std::index_sequence<N...>) {
+    return { { &networkSort<static_cast<int>(N)>... } };
+}
+
+static_assert(NETWORKS[MAX_NETWORK_SIZE].size == MAX_NETWORK_COMPARATORS, "comparator buffer must fit the largest network");
+
+const std::array<NetworkSorter, MAX_NETWORK_SIZE + 1> NETWORK_SORTERS =
+    makeNetworkSorters(std::make_index_sequence<MAX_NETWORK_SIZE + 1>());
+
+// Ranges of at most NETWORK_CUTOFF elements are finished by a network in mergeSort and quickSort.
+// With networkSort leaves, the engine sweep in --benchmark-networks kept improving up to the largest
+// network (about 35% faster than cutoff 1 at n = 100000). Override with --network-cutoff.
+int NETWORK_CUTOFF = MAX_NETWORK_SIZE;
+
+// Set by the headless benchmarks, where nothing is drawn between steps: network leaves then run unrolled
+// in one locked step. Comparisons and swaps are counted the same either way.
+bool UNROLLED_LEAVES = false;
+
+// Visualized leaf: the same comparators as networkSort, one step per compare-exchange, or the whole
+// unrolled network at once under UNROLLED_LEAVES
+void sortingNetworkVisualized(std::vector<int>& data, int left, int right, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    const NetworkComparators& net = NETWORKS[right - left + 1];
+    if (UNROLLED_LEAVES) {
+        size_t exchanges = 0;
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            NETWORK_SORTERS[right - left + 1](&data[left], exchanges);
+        }
+        comparisons += net.size;
+        swaps += exchanges;
+        return;
+    }
+    for (int c = 0; c < net.size && !isAborted; ++c) {
+        int i = left + net.a[c];
+        int j = left + net.b[c];
+        comparisons++;
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            if (data[i] > data[j]) swaps++;
+            compareExchange(data[i], data[j]);
+            highlightedIndices = { i, j };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+    }
+}
+
 void merge(std::vector<int>& data, int left, int mid, int right, float delay,
     std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
     std::vector<int> temp(right - left + 1);
@@ -157,129 +321,1189 @@ void merge(std::vector<int>& data, int left, int mid, int right, float delay,
             swaps++;
         }
     }
-    while (i <= mid && !isAborted) temp[k++] = data[i++];
-    while (j <= right && !isAborted) temp[k++] = data[j++];
+    while (i <= mid && !isAborted) temp[k++] = data[i++];
+    while (j <= right && !isAborted) temp[k++] = data[j++];
+
+    for (i = left, k = 0; i <= right && !isAborted; ++i, ++k) {
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            data[i] = temp[k];
+            highlightedIndices = { i };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+    }
+    {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        highlightedIndices.clear();
+    }
+}
+
+void mergeSort(std::vector<int>& data, int left, int right, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps,
+    std::atomic<bool>& sorting) {
+    if (left < right && right - left < NETWORK_CUTOFF && !isAborted) {
+        sortingNetworkVisualized(data, left, right, delay, highlightedIndices, comparisons, swaps);
+    }
+    else if (left < right && !isAborted) {
+        int mid = left + (right - left) / 2;
+        mergeSort(data, left, mid, delay, highlightedIndices, comparisons, swaps, sorting);
+        mergeSort(data, mid + 1, right, delay, highlightedIndices, comparisons, swaps, sorting);
+        merge(data, left, mid, right, delay, highlightedIndices, comparisons, swaps);
+    }
+    if (!isAborted && left == 0 && right == static_cast<int>(data.size()) - 1) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+int partition(std::vector<int>& data, int low, int high, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    int pivot = data[high];
+    int i = low - 1;
+
+    for (int j = low; j < high && !isAborted; ++j) {
+        comparisons++;
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            highlightedIndices = { j, high };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+
+        if (data[j] < pivot) {
+            i++;
+            {
+                std::lock_guard<std::mutex> lock(dataMutex);
+                std::swap(data[i], data[j]);
+                swaps++;
+                highlightedIndices = { i, j };
+            }
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        std::swap(data[i + 1], data[high]);
+        swaps++;
+        highlightedIndices = { i + 1, high };
+    }
+    return i + 1;
+}
+
+void quickSort(std::vector<int>& data, int low, int high, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps,
+    std::atomic<bool>& sorting) {
+    if (low < high && high - low < NETWORK_CUTOFF && !isAborted) {
+        sortingNetworkVisualized(data, low, high, delay, highlightedIndices, comparisons, swaps);
+    }
+    else if (low < high && !isAborted) {
+        int pi = partition(data, low, high, delay, highlightedIndices, comparisons, swaps);
+        quickSort(data, low, pi - 1, delay, highlightedIndices, comparisons, swaps, sorting);
+        quickSort(data, pi + 1, high, delay, highlightedIndices, comparisons, swaps, sorting);
+    }
+    if (!isAborted && low == 0 && high == static_cast<int>(data.size()) - 1) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+void heapify(std::vector<int>& data, int n, int i, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    int largest = i;
+    int l = 2 * i + 1;
+    int r = 2 * i + 2;
+
+    if (l < n) touchLines(data, l, std::min(r, n - 1));
+
+    if (l < n) comparisons++;
+    if (l < n && data[l] > data[largest]) largest = l;
+
+    if (r < n) comparisons++;
+    if (r < n && data[r] > data[largest]) largest = r;
+
+    if (largest != i && !isAborted) {
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[i], data[largest]);
+            swaps++;
+            highlightedIndices = { i, largest };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+        heapify(data, n, largest, delay, highlightedIndices, comparisons, swaps);
+    }
+}
+
+// Sort-down phase shared by the heap sorts: move the maximum of the heap in data[base..base+size)
+// behind it, then let sift(heapSize, root) repair what is left
+void sortDownHeap(std::vector<int>& data, int base, int size, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& swaps, const std::function<void(int, int)>& sift) {
+    for (int i = size - 1; i > 0 && !isAborted; --i) {
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[base], data[base + i]);
+            swaps++;
+            highlightedIndices = { base, base + i };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+        sift(i, 0);
+    }
+}
+
+void heapSortVisualized(std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    int n = static_cast<int>(data.size());
+    auto sift = [&](int size, int root) { heapify(data, size, root, delay, highlightedIndices, comparisons, swaps); };
+    for (int i = n / 2 - 1; i >= 0 && !isAborted; --i)
+        sift(n, i);
+    sortDownHeap(data, 0, n, delay, highlightedIndices, swaps, sift);
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// Floyd's bottom-up sift: walk down to a leaf along the larger child (one comparison per level),
+// climb back up to where data[i] belongs, then rotate the path so that every element moves once.
+void heapifyBottomUp(std::vector<int>& data, int n, int i, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    int j = i;
+    while (2 * j + 2 < n && !isAborted) {
+        touchLines(data, 2 * j + 1, 2 * j + 2);
+        comparisons++;
+        j = data[2 * j + 1] > data[2 * j + 2] ? 2 * j + 1 : 2 * j + 2;
+    }
+    if (2 * j + 1 < n) {
+        touchLines(data, 2 * j + 1, 2 * j + 1);
+        j = 2 * j + 1;
+    }
+
+    while (j > i && !isAborted) {
+        comparisons++;
+        if (data[i] <= data[j]) break;
+        j = (j - 1) / 2;
+    }
+    if (j == i || isAborted) return;
+
+    int carried;
+    {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        carried = data[j];
+        data[j] = data[i];
+        swaps++;
+        highlightedIndices = { i, j };
+    }
+    pauseCheck();
+    std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+    while (j > i && !isAborted) {
+        j = (j - 1) / 2;
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(carried, data[j]);
+            swaps++;
+            highlightedIndices = { j };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+    }
+}
+
+void heapSortBottomUpVisualized(std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    int n = static_cast<int>(data.size());
+    auto sift = [&](int size, int root) { heapifyBottomUp(data, size, root, delay, highlightedIndices, comparisons, swaps); };
+    for (int i = n / 2 - 1; i >= 0 && !isAborted; --i)
+        sift(n, i);
+    sortDownHeap(data, 0, n, delay, highlightedIndices, swaps, sift);
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// First physical slot of a HEAP_ARITY-ary heap in data such that slot base + 1, and with it every
+// sibling group base + HEAP_ARITY * i + 1, starts on a HEAP_ARITY-int boundary; as that divides
+// CACHE_LINE_BYTES, no group straddles two lines
+int alignedHeapBase(const std::vector<int>& data) {
+    uintptr_t firstChild = reinterpret_cast<uintptr_t>(data.data()) / sizeof(int) + 1;
+    return static_cast<int>((HEAP_ARITY - firstChild % HEAP_ARITY) % HEAP_ARITY);
+}
+
+// Iterative sift for the HEAP_ARITY-ary heap stored at data[base..base+n): the children of i are
+// HEAP_ARITY * i + 1 .. HEAP_ARITY * i + HEAP_ARITY, inside one line, so each level costs one miss
+void heapifyDAry(std::vector<int>& data, int base, int n, int i, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    while (!isAborted) {
+        int first = HEAP_ARITY * i + 1;
+        if (first >= n) return;
+        int last = std::min(first + HEAP_ARITY, n);
+        touchLines(data, base + first, base + last - 1);
+
+        int largest = first;
+        for (int c = first + 1; c < last; ++c) {
+            comparisons++;
+            if (data[base + c] > data[base + largest]) largest = c;
+        }
+        comparisons++;
+        if (data[base + largest] <= data[base + i]) return;
+
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[base + i], data[base + largest]);
+            swaps++;
+            highlightedIndices = { base + i, base + largest };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+        i = largest;
+    }
+}
+
+// Folds the sorted data[0..b) into the sorted data[b..end): each prefix value binary-searches the
+// tail for the block of smaller values, which moves left in one step. That costs b * log n comparisons
+// and b locked steps, and each tail value moves at most once, where merge() would compare and lock
+// for every element to place a handful.
+void foldSortedPrefix(std::vector<int>& data, int b, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    std::vector<int> prefix(data.begin(), data.begin() + b);
+    int w = 0, t = b;
+    for (int k = 0; k < b && !isAborted; ++k) {
+        int end = static_cast<int>(std::lower_bound(data.begin() + t, data.end(), prefix[k],
+            [&](int a, int v) { comparisons++; return a < v; }) - data.begin());
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::move(data.begin() + t, data.begin() + end, data.begin() + w);
+            w += end - t;
+            swaps += end - t;
+            t = end;
+            data[w] = prefix[k];
+            highlightedIndices = { w };
+            w++;
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+    }
+}
+
+// The fewer than HEAP_ARITY slots in front of the aligned heap are sorted by a network and folded
+// into the heap-sorted rest at the end
+void heapSortDAryVisualized(std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    int total = static_cast<int>(data.size());
+    int base = std::min(alignedHeapBase(data), total);
+    int n = total - base;
+
+    if (base > 1) sortingNetworkVisualized(data, 0, base - 1, delay, highlightedIndices, comparisons, swaps);
+    auto sift = [&](int size, int root) { heapifyDAry(data, base, size, root, delay, highlightedIndices, comparisons, swaps); };
+    for (int i = (n - 2) / HEAP_ARITY; i >= 0 && !isAborted; --i)
+        sift(n, i);
+    sortDownHeap(data, base, n, delay, highlightedIndices, swaps, sift);
+    if (base > 0 && n > 0 && !isAborted) foldSortedPrefix(data, base, delay, highlightedIndices, comparisons, swaps);
+
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// Same comparisons as heapify, but iterative and prefetching the four grandchildren (one contiguous
+// block starting at 4 * i + 3) while the current level's children are still being compared.
+void heapifyPrefetch(std::vector<int>& data, int n, int i, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    while (!isAborted) {
+        if (4 * i + 3 < n) PREFETCH(&data[4 * i + 3]);
+
+        int largest = i;
+        int l = 2 * i + 1;
+        int r = 2 * i + 2;
+
+        if (l < n) touchLines(data, l, std::min(r, n - 1));
+
+        if (l < n) comparisons++;
+        if (l < n && data[l] > data[largest]) largest = l;
+
+        if (r < n) comparisons++;
+        if (r < n && data[r] > data[largest]) largest = r;
+
+        if (largest == i) return;
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[i], data[largest]);
+            swaps++;
+            highlightedIndices = { i, largest };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+        i = largest;
+    }
+}
+
+void heapSortPrefetchVisualized(std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    int n = static_cast<int>(data.size());
+    auto sift = [&](int size, int root) { heapifyPrefetch(data, size, root, delay, highlightedIndices, comparisons, swaps); };
+    for (int i = n / 2 - 1; i >= 0 && !isAborted; --i)
+        sift(n, i);
+    sortDownHeap(data, 0, n, delay, highlightedIndices, swaps, sift);
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// Selection engines: put the k smallest values at the front without sorting the rest. They share
+// partition() with quickSort and heapify() with heapSortVisualized.
+
+// Median of data[low], data[mid], data[high] ends up at data[high], where partition() takes its pivot
+void medianOfThreeToHigh(std::vector<int>& data, int low, int high,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    int mid = low + (high - low) / 2;
+    comparisons += 2;
+    int a = data[low], b = data[mid], c = data[high];
+    int median = (a < b) ? (b < c ? mid : (a < c ? high : low)) : (a < c ? low : (b < c ? high : mid));
+    if (median != high) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        std::swap(data[median], data[high]);
+        swaps++;
+        highlightedIndices = { median, high };
+    }
+}
+
+// Leaves a max-heap of the k smallest values of data[0..end] in data[0..k): heapify the prefix,
+// then every later value only costs a comparison with the root unless it belongs in the heap.
+void selectIntoHeap(std::vector<int>& data, int k, int end, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    for (int i = k / 2 - 1; i >= 0 && !isAborted; --i)
+        heapify(data, k, i, delay, highlightedIndices, comparisons, swaps);
+    for (int i = k; i <= end && !isAborted; ++i) {
+        comparisons++;
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            highlightedIndices = { 0, i };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+        if (data[i] < data[0]) {
+            {
+                std::lock_guard<std::mutex> lock(dataMutex);
+                std::swap(data[0], data[i]);
+                swaps++;
+            }
+            heapify(data, k, 0, delay, highlightedIndices, comparisons, swaps);
+        }
+    }
+}
+
+// Quickselect on data[low..high] for index k with median-of-three pivots. Once the partition depth
+// exceeds depthLimit it falls back to selectIntoHeap over data[0..high], which is valid because
+// everything left of low is already no larger than the range: O(n log k) worst case instead of O(n^2).
+void introSelect(std::vector<int>& data, int low, int high, int k, int depthLimit, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    while (low < high && !isAborted) {
+        if (depthLimit-- == 0) {
+            selectIntoHeap(data, k + 1, high, delay, highlightedIndices, comparisons, swaps);
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[0], data[k]);
+            swaps++;
+            return;
+        }
+        medianOfThreeToHigh(data, low, high, highlightedIndices, comparisons, swaps);
+        int pi = partition(data, low, high, delay, highlightedIndices, comparisons, swaps);
+        if (pi == k) return;
+        if (pi < k) low = pi + 1;
+        else high = pi - 1;
+    }
+}
+
+void introSelectVisualized(std::vector<int>& data, int k, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    int n = static_cast<int>(data.size());
+    int depthLimit = 2 * static_cast<int>(std::log2(std::max(n, 2)));
+    introSelect(data, 0, n - 1, k - 1, depthLimit, delay, highlightedIndices, comparisons, swaps);
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices = { k - 1 };
+    }
+}
+
+// Floyd-Rivest: on ranges above 600 elements, first select k inside a small sample window sized so
+// that data[k] is almost surely close to the true k-th value, then partition the range once around it.
+// Duplicates defeat the sampling (Lomuto peels one copy of the pivot per pass), so the same depthLimit
+// as introSelect bounds the passes, shared by reference with the window calls: every partition at any
+// level spends from one budget, so there are never more passes than introselect would make. The
+// top-level call then falls back to selectIntoHeap; the window calls (pivotOnly) only choose a pivot
+// and simply stop, since data left of the window may be larger.
+void floydRivestSelect(std::vector<int>& data, int left, int right, int k, int& depthLimit, bool pivotOnly,
+    float delay, std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    while (right > left && !isAborted) {
+        if (depthLimit <= 0) {
+            if (pivotOnly) return;
+            selectIntoHeap(data, k + 1, right, delay, highlightedIndices, comparisons, swaps);
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[0], data[k]);
+            swaps++;
+            return;
+        }
+        if (right - left > 600) {
+            double n = right - left + 1;
+            double i = k - left + 1;
+            double z = std::log(n);
+            double s = 0.5 * std::exp(2.0 * z / 3.0);
+            double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2 ? -1.0 : 1.0);
+            int newLeft = std::max(left, static_cast<int>(k - i * s / n + sd));
+            int newRight = std::min(right, static_cast<int>(k + (n - i) * s / n + sd));
+            floydRivestSelect(data, newLeft, newRight, k, depthLimit, true, delay, highlightedIndices, comparisons, swaps);
+            if (depthLimit <= 0) continue;
+        }
+        depthLimit--;
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[k], data[right]);
+            swaps++;
+            highlightedIndices = { k, right };
+        }
+        int pi = partition(data, left, right, delay, highlightedIndices, comparisons, swaps);
+        if (pi == k) return;
+        if (pi < k) left = pi + 1;
+        else right = pi - 1;
+    }
+}
+
+void floydRivestSelectVisualized(std::vector<int>& data, int k, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    int n = static_cast<int>(data.size());
+    int depthLimit = 2 * static_cast<int>(std::log2(std::max(n, 2)));
+    floydRivestSelect(data, 0, n - 1, k - 1, depthLimit, false, delay, highlightedIndices, comparisons, swaps);
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices = { k - 1 };
+    }
+}
+
+// Partial sort: the k smallest values end up sorted in data[0..k), the rest in no particular order
+void heapPartialSortVisualized(std::vector<int>& data, int k, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    selectIntoHeap(data, k, static_cast<int>(data.size()) - 1, delay, highlightedIndices, comparisons, swaps);
+    sortDownHeap(data, 0, k, delay, highlightedIndices, swaps,
+        [&](int size, int root) { heapify(data, size, root, delay, highlightedIndices, comparisons, swaps); });
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// The prefix in front of the k-th value is heap-sorted rather than quicksorted: quickSort's Lomuto
+// partition is quadratic on duplicates, which a large k over low-cardinality data hits at full size.
+void quickSelectPartialSortVisualized(std::vector<int>& data, int k, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    int n = static_cast<int>(data.size());
+    int depthLimit = 2 * static_cast<int>(std::log2(std::max(n, 2)));
+    introSelect(data, 0, n - 1, k - 1, depthLimit, delay, highlightedIndices, comparisons, swaps);
+    auto sift = [&](int size, int root) { heapify(data, size, root, delay, highlightedIndices, comparisons, swaps); };
+    for (int i = (k - 1) / 2 - 1; i >= 0 && !isAborted; --i)
+        sift(k - 1, i);
+    sortDownHeap(data, 0, k - 1, delay, highlightedIndices, swaps, sift);
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// Offers data[i] to the bounded max-heap data[0..heapSize). Until the heap holds k values the new one is
+// sifted up; after that it replaces the root only if smaller, so the heap always keeps the k smallest
+// values seen so far and memory stays O(k) however long the stream is. Requires heapSize <= i.
+void topKOffer(std::vector<int>& data, int& heapSize, int k, int i, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    if (heapSize < k) {
+        int child = heapSize++;
+        if (child != i) {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[child], data[i]);
+            swaps++;
+        }
+        while (child > 0 && !isAborted) {
+            int parent = (child - 1) / 2;
+            comparisons++;
+            if (data[parent] >= data[child]) break;
+            {
+                std::lock_guard<std::mutex> lock(dataMutex);
+                std::swap(data[parent], data[child]);
+                swaps++;
+                highlightedIndices = { parent, child };
+            }
+            pauseCheck();
+            std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+            child = parent;
+        }
+        return;
+    }
+
+    comparisons++;
+    {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        highlightedIndices = { 0, i };
+    }
+    pauseCheck();
+    std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+    if (data[i] < data[0]) {
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            std::swap(data[0], data[i]);
+            swaps++;
+        }
+        heapify(data, k, 0, delay, highlightedIndices, comparisons, swaps);
+    }
+}
+
+// The bars are consumed left to right as a stream; the heap lives in the front k bars
+void streamingTopKVisualized(std::vector<int>& data, int k, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    int heapSize = 0;
+    for (int i = 0; i < static_cast<int>(data.size()) && !isAborted; ++i)
+        topKOffer(data, heapSize, k, i, delay, highlightedIndices, comparisons, swaps);
+    sortDownHeap(data, 0, heapSize, delay, highlightedIndices, swaps,
+        [&](int size, int root) { heapify(data, size, root, delay, highlightedIndices, comparisons, swaps); });
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// Strings live back-to-back in one byte buffer; the sorts below permute the 8-byte StringRef handles,
+// never the characters, so moving a key costs the same as moving an int and nothing is reallocated.
+struct StringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct StringArena {
+    std::vector<char> bytes;
+    std::vector<StringRef> keys;
+};
+
+// Refuses the key (returns false) once the arena would outgrow the 32-bit offsets or the int key indices
+bool appendString(StringArena& arena, const char* text, size_t length) {
+    if (length > UINT32_MAX - arena.bytes.size() || arena.keys.size() >= static_cast<size_t>(INT_MAX)) return false;
+    StringRef ref = { static_cast<uint32_t>(arena.bytes.size()), static_cast<uint32_t>(length) };
+    arena.bytes.insert(arena.bytes.end(), text, text + length);
+    arena.keys.push_back(ref);
+    return true;
+}
+
+// Newline-delimited file, one key per line; a trailing '\r' from Windows line endings is dropped
+bool loadStrings(StringArena& arena, const std::string& path, std::string& error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "Failed to open " + path;
+        return false;
+    }
+    arena.bytes.clear();
+    arena.keys.clear();
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!appendString(arena, line.data(), line.size())) {
+            error = path + " is too large: the string arena holds at most 4 GiB of key bytes and INT_MAX keys";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Every key starts with the same prefixLength characters, followed by 1-8 random lowercase letters
+void generateStrings(StringArena& arena, int count, int prefixLength) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+    std::uniform_int_distribution<> letter('a', 'z');
+    std::uniform_int_distribution<> suffixLength(1, 8);
+    std::string prefix;
+    for (int i = 0; i < prefixLength; ++i) prefix += static_cast<char>(letter(g));
+
+    arena.bytes.clear();
+    arena.keys.clear();
+    std::string key;
+    for (int i = 0; i < count; ++i) {
+        key = prefix;
+        for (int c = suffixLength(g); c > 0; --c) key += static_cast<char>(letter(g));
+        appendString(arena, key.data(), key.size());
+    }
+}
+
+// Byte d of s as 0..255, or -1 past the end so shorter keys sort first
+inline int charAt(const StringArena& arena, const StringRef& s, int d) {
+    return d < static_cast<int>(s.length) ? static_cast<unsigned char>(arena.bytes[s.offset + d]) : -1;
+}
+
+bool stringLess(const StringArena& arena, const StringRef& a, const StringRef& b) {
+    const unsigned char* pa = reinterpret_cast<const unsigned char*>(arena.bytes.data()) + a.offset;
+    const unsigned char* pb = reinterpret_cast<const unsigned char*>(arena.bytes.data()) + b.offset;
+    return std::lexicographical_compare(pa, pa + a.length, pb, pb + b.length);
+}
+
+// Bar height for each key from its dense rank in sorted order (equal keys share a rank), so a sorted
+// arena draws as a rising ramp whichever order an unstable sort leaves duplicates in
+void rankStringBars(const StringArena& arena, std::vector<int>& data) {
+    int n = static_cast<int>(arena.keys.size());
+    std::vector<int> order(n);
+    for (int i = 0; i < n; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(),
+        [&](int a, int b) { return stringLess(arena, arena.keys[a], arena.keys[b]); });
+    std::vector<int> rank(n, 0);
+    for (int i = 1; i < n; ++i)
+        rank[i] = rank[i - 1] + (stringLess(arena, arena.keys[order[i - 1]], arena.keys[order[i]]) ? 1 : 0);
+    int maxRank = n > 0 ? rank[n - 1] : 0;
+    data.assign(n, 50);
+    for (int i = 0; i < n; ++i)
+        data[order[i]] = 50 + (maxRank > 0 ? rank[i] * (WINDOW_HEIGHT - 150) / maxRank : 0);
+}
+
+// Keys and their bars always move together
+void swapStringKeys(StringArena& arena, std::vector<int>& data, int a, int b,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& swaps) {
+    std::lock_guard<std::mutex> lock(dataMutex);
+    std::swap(arena.keys[a], arena.keys[b]);
+    std::swap(data[a], data[b]);
+    swaps++;
+    highlightedIndices = { a, b };
+}
+
+// Bentley-Sedgewick three-way radix quicksort: partition on byte d only, and continue the equal band
+// at d + 1, so a shared prefix is inspected once per key instead of once per comparison. The largest
+// of the three bands is continued in the loop and only the other two recurse, so each recursion at
+// least halves the range: stack depth is O(log n) however long the common prefix (which comes from
+// user files) is.
+void multikeyQuickSort(StringArena& arena, std::vector<int>& data, int low, int high, int d, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    for (;;) {
+        if (low >= high || isAborted) return;
+        charDepth = d;
+        int pivot = charAt(arena, arena.keys[low + (high - low) / 2], d);
+        int lt = low, i = low, gt = high;
+
+        while (i <= gt && !isAborted) {
+            comparisons++;
+            {
+                std::lock_guard<std::mutex> lock(dataMutex);
+                highlightedIndices = { i, gt };
+            }
+            pauseCheck();
+            std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+
+            int c = charAt(arena, arena.keys[i], d);
+            if (c < pivot) swapStringKeys(arena, data, lt++, i++, highlightedIndices, swaps);
+            else if (c > pivot) swapStringKeys(arena, data, i, gt--, highlightedIndices, swaps);
+            else i++;
+        }
+
+        // Bands as { low, high, d }; keys that ended at d (pivot -1) are all equal and need no more work
+        int bands[3][3] = { { low, lt - 1, d }, { lt, pivot >= 0 ? gt : lt - 1, d + 1 }, { gt + 1, high, d } };
+        int largest = 0;
+        for (int b = 1; b < 3; ++b)
+            if (bands[b][1] - bands[b][0] > bands[largest][1] - bands[largest][0]) largest = b;
+        for (int b = 0; b < 3; ++b)
+            if (b != largest)
+                multikeyQuickSort(arena, data, bands[b][0], bands[b][1], bands[b][2], delay, highlightedIndices, comparisons, swaps);
+        low = bands[largest][0];
+        high = bands[largest][1];
+        d = bands[largest][2];
+    }
+}
+
+void multikeyQuickSortVisualized(StringArena& arena, std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    multikeyQuickSort(arena, data, 0, static_cast<int>(arena.keys.size()) - 1, 0, delay,
+        highlightedIndices, comparisons, swaps);
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// Insertion sort for keys already known to agree on their first d bytes
+void stringInsertionSort(StringArena& arena, std::vector<int>& data, int low, int high, int d, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    for (int i = low + 1; i <= high && !isAborted; ++i) {
+        for (int j = i; j > low && !isAborted; --j) {
+            int h = d;
+            int a, b;
+            do {
+                comparisons++;
+                a = charAt(arena, arena.keys[j - 1], h);
+                b = charAt(arena, arena.keys[j], h);
+                h++;
+            } while (a == b && a >= 0);
+            if (a <= b) break;
+
+            swapStringKeys(arena, data, j - 1, j, highlightedIndices, swaps);
+            pauseCheck();
+            std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+        }
+    }
+}
+
+const int MSD_CUTOFF = 16;
+
+// MSD radix sort on byte d with 257 buckets (bucket 0 = end of key); ranges of MSD_CUTOFF keys or
+// fewer go to insertion sort, which is cheaper than clearing and scanning the count array.
+void msdRadixSort(StringArena& arena, std::vector<int>& data, std::vector<StringRef>& auxKeys, std::vector<int>& auxData,
+    int low, int high, int d, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    if (isAborted) return;
+    if (high - low + 1 <= MSD_CUTOFF) {
+        stringInsertionSort(arena, data, low, high, d, delay, highlightedIndices, comparisons, swaps);
+        return;
+    }
+
+    // count[c + 2] counts byte c, so count[1] is the end-of-key bucket. A shared prefix byte (NUL included)
+    // puts every key in one bucket: skip the distribution pass and advance d in place rather than recursing,
+    // so a long common prefix costs one count pass per byte and no stack frames.
+    int count[258];
+    for (;;) {
+        charDepth = d;
+        std::fill(count, count + 258, 0);
+        for (int i = low; i <= high; ++i) {
+            comparisons++;
+            count[charAt(arena, arena.keys[i], d) + 2]++;
+        }
+        if (count[1] == high - low + 1) return;  // every key ends at d: all equal
+        int r = 2;
+        while (r < 258 && count[r] != high - low + 1) ++r;
+        if (r == 258 || isAborted) break;
+        ++d;
+    }
+    if (isAborted) return;
+    for (int r = 0; r < 257; ++r) count[r + 1] += count[r];
+    for (int i = low; i <= high; ++i) {
+        int slot = count[charAt(arena, arena.keys[i], d) + 1]++;
+        auxKeys[slot] = arena.keys[i];
+        auxData[slot] = data[i];
+    }
+    for (int i = low, k = 0; i <= high && !isAborted; ++i, ++k) {
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            arena.keys[i] = auxKeys[k];
+            data[i] = auxData[k];
+            swaps++;
+            highlightedIndices = { i };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+    }
+
+    // After distribution count[b] is the end of bucket b; keys that ended at d (bucket 0) are done
+    for (int b = 1; b < 257 && !isAborted; ++b) {
+        if (count[b] - count[b - 1] > 1)
+            msdRadixSort(arena, data, auxKeys, auxData, low + count[b - 1], low + count[b] - 1, d + 1, delay,
+                highlightedIndices, comparisons, swaps);
+    }
+}
+
+void msdRadixSortVisualized(StringArena& arena, std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    std::vector<StringRef> auxKeys(arena.keys.size());
+    std::vector<int> auxData(arena.keys.size());
+    msdRadixSort(arena, data, auxKeys, auxData, 0, static_cast<int>(arena.keys.size()) - 1, 0, delay,
+        highlightedIndices, comparisons, swaps);
+    if (!isAborted) {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        sorting = false;
+        highlightedIndices.clear();
+    }
+}
+
+// Ng-Kakehi LCP merge. lcp[i] is the common-prefix length of key i with its predecessor in the run.
+// Each side tracks its LCP with the last key output: if they differ, the side with the longer LCP
+// is smaller without touching a byte; only on a tie are bytes compared, starting at that depth.
+void lcpMerge(StringArena& arena, std::vector<int>& data, std::vector<int>& lcp,
+    std::vector<StringRef>& auxKeys, std::vector<int>& auxData, std::vector<int>& auxLcp,
+    int left, int mid, int right, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
+    int i = left, j = mid + 1, k = 0;
+    int lcpA = 0, lcpB = 0;
+
+    auto take = [&](int from, int outLcp) {
+        auxKeys[k] = arena.keys[from];
+        auxData[k] = data[from];
+        auxLcp[k] = outLcp;
+        k++;
+    };
+
+    while (i <= mid && j <= right && !isAborted) {
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            highlightedIndices = { i, j };
+        }
+        pauseCheck();
+        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+
+        if (lcpA > lcpB) {
+            take(i, lcpA);
+            lcpA = ++i <= mid ? lcp[i] : 0;
+        }
+        else if (lcpB > lcpA) {
+            take(j, lcpB);
+            lcpB = ++j <= right ? lcp[j] : 0;
+            swaps++;
+        }
+        else {
+            int h = lcpA;
+            int a, b;
+            charDepth = h;
+            for (;;) {
+                comparisons++;
+                a = charAt(arena, arena.keys[i], h);
+                b = charAt(arena, arena.keys[j], h);
+                if (a != b || a < 0) break;
+                h++;
+            }
+            if (a <= b) {
+                take(i, lcpA);
+                lcpB = h;
+                lcpA = ++i <= mid ? lcp[i] : 0;
+            }
+            else {
+                take(j, lcpB);
+                lcpA = h;
+                lcpB = ++j <= right ? lcp[j] : 0;
+                swaps++;
+            }
+        }
+    }
+    if (i <= mid) { take(i, lcpA); ++i; }
+    while (i <= mid) { take(i, lcp[i]); ++i; }
+    if (j <= right) { take(j, lcpB); ++j; }
+    while (j <= right) { take(j, lcp[j]); ++j; }
 
     for (i = left, k = 0; i <= right && !isAborted; ++i, ++k) {
         {
             std::lock_guard<std::mutex> lock(dataMutex);
-            data[i] = temp[k];
+            arena.keys[i] = auxKeys[k];
+            data[i] = auxData[k];
+            lcp[i] = auxLcp[k];
             highlightedIndices = { i };
         }
         pauseCheck();
         std::this_thread::sleep_for(std::chrono::duration<float>(delay));
     }
-    {
-        std::lock_guard<std::mutex> lock(dataMutex);
-        highlightedIndices.clear();
-    }
 }
 
-void mergeSort(std::vector<int>& data, int left, int right, float delay,
-    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps,
-    std::atomic<bool>& sorting) {
+void lcpMergeSort(StringArena& arena, std::vector<int>& data, std::vector<int>& lcp,
+    std::vector<StringRef>& auxKeys, std::vector<int>& auxData, std::vector<int>& auxLcp,
+    int left, int right, float delay,
+    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
     if (left < right && !isAborted) {
         int mid = left + (right - left) / 2;
-        mergeSort(data, left, mid, delay, highlightedIndices, comparisons, swaps, sorting);
-        mergeSort(data, mid + 1, right, delay, highlightedIndices, comparisons, swaps, sorting);
-        merge(data, left, mid, right, delay, highlightedIndices, comparisons, swaps);
+        lcpMergeSort(arena, data, lcp, auxKeys, auxData, auxLcp, left, mid, delay, highlightedIndices, comparisons, swaps);
+        lcpMergeSort(arena, data, lcp, auxKeys, auxData, auxLcp, mid + 1, right, delay, highlightedIndices, comparisons, swaps);
+        lcpMerge(arena, data, lcp, auxKeys, auxData, auxLcp, left, mid, right, delay, highlightedIndices, comparisons, swaps);
     }
-    if (!isAborted && left == 0 && right == static_cast<int>(data.size()) - 1) {
+}
+
+void lcpMergeSortVisualized(StringArena& arena, std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    size_t n = arena.keys.size();
+    std::vector<int> lcp(n, 0), auxData(n), auxLcp(n);
+    std::vector<StringRef> auxKeys(n);
+    lcpMergeSort(arena, data, lcp, auxKeys, auxData, auxLcp, 0, static_cast<int>(n) - 1, delay,
+        highlightedIndices, comparisons, swaps);
+    if (!isAborted) {
         std::lock_guard<std::mutex> lock(dataMutex);
         sorting = false;
         highlightedIndices.clear();
     }
 }
 
-int partition(std::vector<int>& data, int low, int high, float delay,
-    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
-    int pivot = data[high];
-    int i = low - 1;
+// Live updates: a producer streams inserts, erases and value changes; the consumer applies them in
+// batches so the array stays sorted without ever re-sorting it from scratch.
+enum class LiveUpdateKind { Insert, Erase, Change };
+
+struct LiveUpdate {
+    LiveUpdateKind kind;
+    int value;    // value to insert, erase, or change from
+    int newValue; // Change only
+    std::chrono::steady_clock::time_point queuedAt;
+};
+
+// Producer-side model of the multiset, so every erase and change targets a value that is present
+LiveUpdate nextLiveUpdate(std::vector<int>& live, std::mt19937& g, size_t minSize, size_t maxSize, int minValue, int maxValue) {
+    std::uniform_int_distribution<> valueDist(minValue, maxValue);
+    LiveUpdate update;
+    update.queuedAt = std::chrono::steady_clock::now();
+    int roll = std::uniform_int_distribution<>(0, 2)(g);
+    if (live.size() <= minSize) roll = 0;
+    else if (live.size() >= maxSize) roll = 1;
+
+    if (roll == 0) {
+        update.kind = LiveUpdateKind::Insert;
+        update.value = valueDist(g);
+        live.push_back(update.value);
+        return update;
+    }
+    size_t victim = std::uniform_int_distribution<size_t>(0, live.size() - 1)(g);
+    update.value = live[victim];
+    if (roll == 1) {
+        update.kind = LiveUpdateKind::Erase;
+        live[victim] = live.back();
+        live.pop_back();
+    }
+    else {
+        update.kind = LiveUpdateKind::Change;
+        update.newValue = valueDist(g);
+        live[victim] = update.newValue;
+    }
+    return update;
+}
 
-    for (int j = low; j < high && !isAborted; ++j) {
-        comparisons++;
-        {
-            std::lock_guard<std::mutex> lock(dataMutex);
-            highlightedIndices = { j, high };
-        }
-        pauseCheck();
-        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
+// Splits a batch into sorted insert and erase lists; a change is an erase of the old value plus an insert
+void sortLiveBatch(const std::vector<LiveUpdate>& batch, std::vector<int>& inserts, std::vector<int>& erases) {
+    inserts.clear();
+    erases.clear();
+    for (const LiveUpdate& update : batch) {
+        if (update.kind != LiveUpdateKind::Erase) inserts.push_back(update.kind == LiveUpdateKind::Insert ? update.value : update.newValue);
+        if (update.kind != LiveUpdateKind::Insert) erases.push_back(update.value);
+    }
+    std::sort(inserts.begin(), inserts.end());
+    std::sort(erases.begin(), erases.end());
+}
 
-        if (data[j] < pivot) {
-            i++;
-            {
-                std::lock_guard<std::mutex> lock(dataMutex);
-                std::swap(data[i], data[j]);
-                swaps++;
-                highlightedIndices = { i, j };
-            }
+// One linear pass: (sorted + inserts) - erases as multisets, which matches applying the batch in order
+// because the producer only erases values that are present at the time.
+void mergeLiveBatch(std::vector<int>& sorted, const std::vector<int>& inserts, const std::vector<int>& erases,
+    std::vector<int>& scratch) {
+    scratch.clear();
+    scratch.reserve(sorted.size() + inserts.size());
+    size_t i = 0, j = 0, e = 0;
+    while (i < sorted.size() || j < inserts.size()) {
+        int v = (j == inserts.size() || (i < sorted.size() && sorted[i] <= inserts[j])) ? sorted[i++] : inserts[j++];
+        while (e < erases.size() && erases[e] < v) e++;
+        if (e < erases.size() && erases[e] == v) {
+            e++;
+            continue;
         }
+        scratch.push_back(v);
     }
-    {
-        std::lock_guard<std::mutex> lock(dataMutex);
-        std::swap(data[i + 1], data[high]);
-        swaps++;
-        highlightedIndices = { i + 1, high };
+    sorted.swap(scratch);
+}
+
+const int LIVE_BLOCK_CAPACITY = 64; // 256-byte leaves: four cache lines, shifted with one memmove
+
+// Sorted multiset as a run of sorted leaf blocks plus an array of each block's maximum, i.e. a
+// two-level B+-tree. A single update costs a binary search over blockMax and a shift inside one
+// leaf, instead of the O(n) pass a merge into a flat array needs.
+struct BlockedSortedArray {
+    std::vector<std::vector<int>> blocks;
+    std::vector<int> blockMax;
+    size_t size = 0;
+};
+
+void blockedBuild(BlockedSortedArray& tree, const std::vector<int>& sorted) {
+    tree.blocks.clear();
+    tree.blockMax.clear();
+    tree.size = sorted.size();
+    // Half-full leaves leave room for inserts before the first splits
+    for (size_t i = 0; i < sorted.size(); i += LIVE_BLOCK_CAPACITY / 2) {
+        size_t end = std::min(sorted.size(), i + LIVE_BLOCK_CAPACITY / 2);
+        tree.blocks.emplace_back(sorted.begin() + i, sorted.begin() + end);
+        tree.blockMax.push_back(sorted[end - 1]);
     }
-    return i + 1;
 }
 
-void quickSort(std::vector<int>& data, int low, int high, float delay,
-    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps,
-    std::atomic<bool>& sorting) {
-    if (low < high && !isAborted) {
-        int pi = partition(data, low, high, delay, highlightedIndices, comparisons, swaps);
-        quickSort(data, low, pi - 1, delay, highlightedIndices, comparisons, swaps, sorting);
-        quickSort(data, pi + 1, high, delay, highlightedIndices, comparisons, swaps, sorting);
+void blockedFlatten(const BlockedSortedArray& tree, std::vector<int>& out) {
+    out.clear();
+    out.reserve(tree.size);
+    for (const std::vector<int>& block : tree.blocks) out.insert(out.end(), block.begin(), block.end());
+}
+
+void blockedInsert(BlockedSortedArray& tree, int value) {
+    tree.size++;
+    if (tree.blocks.empty()) {
+        tree.blocks.push_back({ value });
+        tree.blockMax.push_back(value);
+        return;
     }
-    if (!isAborted && low == 0 && high == static_cast<int>(data.size()) - 1) {
-        std::lock_guard<std::mutex> lock(dataMutex);
-        sorting = false;
-        highlightedIndices.clear();
+    size_t b = std::lower_bound(tree.blockMax.begin(), tree.blockMax.end(), value) - tree.blockMax.begin();
+    if (b == tree.blocks.size()) b--;
+    std::vector<int>& block = tree.blocks[b];
+    block.insert(std::upper_bound(block.begin(), block.end(), value), value);
+    tree.blockMax[b] = block.back();
+
+    if (block.size() > static_cast<size_t>(LIVE_BLOCK_CAPACITY)) {
+        std::vector<int> upper(block.begin() + block.size() / 2, block.end());
+        block.resize(block.size() / 2);
+        tree.blockMax[b] = block.back();
+        tree.blockMax.insert(tree.blockMax.begin() + b + 1, upper.back());
+        tree.blocks.insert(tree.blocks.begin() + b + 1, std::move(upper));
     }
 }
 
-void heapify(std::vector<int>& data, int n, int i, float delay,
-    std::vector<int>& highlightedIndices, std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps) {
-    int largest = i;
-    int l = 2 * i + 1;
-    int r = 2 * i + 2;
+bool blockedErase(BlockedSortedArray& tree, int value) {
+    size_t b = std::lower_bound(tree.blockMax.begin(), tree.blockMax.end(), value) - tree.blockMax.begin();
+    if (b == tree.blocks.size()) return false;
+    std::vector<int>& block = tree.blocks[b];
+    auto it = std::lower_bound(block.begin(), block.end(), value);
+    if (it == block.end() || *it != value) return false;
+    block.erase(it);
+    tree.size--;
+
+    if (block.empty()) {
+        tree.blocks.erase(tree.blocks.begin() + b);
+        tree.blockMax.erase(tree.blockMax.begin() + b);
+        return true;
+    }
+    tree.blockMax[b] = block.back();
+    // Fold a quarter-full leaf into its successor so scans do not degrade into many tiny blocks
+    if (block.size() < static_cast<size_t>(LIVE_BLOCK_CAPACITY / 4) && b + 1 < tree.blocks.size()
+        && block.size() + tree.blocks[b + 1].size() <= static_cast<size_t>(LIVE_BLOCK_CAPACITY)) {
+        std::vector<int>& next = tree.blocks[b + 1];
+        next.insert(next.begin(), block.begin(), block.end());
+        tree.blocks.erase(tree.blocks.begin() + b);
+        tree.blockMax.erase(tree.blockMax.begin() + b);
+    }
+    return true;
+}
 
-    if (l < n) comparisons++;
-    if (l < n && data[l] > data[largest]) largest = l;
+enum class LiveStrategy { Merge, Blocked, Adaptive };
+
+// Merging costs O(n) per batch whatever its size, a blocked update about LIVE_BLOCK_CAPACITY moves per
+// value. The adaptive store moves to the blocked structure once batch * LIVE_TREE_RATIO < n and back to
+// merging once batch * LIVE_MERGE_RATIO >= n; the gap keeps a size random walk from converting every batch.
+const int LIVE_TREE_RATIO = 64;
+const int LIVE_MERGE_RATIO = 16;
+
+struct LiveSortedStore {
+    std::vector<int> flat;
+    BlockedSortedArray tree;
+    bool usingTree = false;
+    std::vector<int> inserts, erases, scratch;
+};
+
+void liveApplyBatch(LiveSortedStore& store, const std::vector<LiveUpdate>& batch, LiveStrategy strategy) {
+    size_t n = store.usingTree ? store.tree.size : store.flat.size();
+    bool wantTree = strategy == LiveStrategy::Blocked;
+    if (strategy == LiveStrategy::Adaptive)
+        wantTree = store.usingTree ? batch.size() * LIVE_MERGE_RATIO < n : batch.size() * LIVE_TREE_RATIO < n;
+    if (wantTree && !store.usingTree) blockedBuild(store.tree, store.flat);
+    if (!wantTree && store.usingTree) blockedFlatten(store.tree, store.flat);
+    store.usingTree = wantTree;
+
+    sortLiveBatch(batch, store.inserts, store.erases);
+    if (store.usingTree) {
+        for (int v : store.inserts) blockedInsert(store.tree, v);
+        for (int v : store.erases) blockedErase(store.tree, v);
+    }
+    else {
+        mergeLiveBatch(store.flat, store.inserts, store.erases, store.scratch);
+    }
+}
 
-    if (r < n) comparisons++;
-    if (r < n && data[r] > data[largest]) largest = r;
+// Flat sorted view for drawing; free when the store is already in flat mode
+const std::vector<int>& liveSortedView(LiveSortedStore& store) {
+    if (store.usingTree) blockedFlatten(store.tree, store.flat);
+    return store.flat;
+}
 
-    if (largest != i && !isAborted) {
-        {
-            std::lock_guard<std::mutex> lock(dataMutex);
-            std::swap(data[i], data[largest]);
-            swaps++;
-            highlightedIndices = { i, largest };
-        }
-        pauseCheck();
-        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
-        heapify(data, n, largest, delay, highlightedIndices, comparisons, swaps);
+double percentile(std::vector<double> samples, double p) {
+    if (samples.empty()) return 0.0;
+    size_t index = std::min(samples.size() - 1, static_cast<size_t>(p * samples.size()));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+struct LiveStats {
+    std::atomic<size_t> applied{ 0 };
+    std::atomic<double> p99Ms{ 0.0 };
+};
+
+// pauseCheck for live mode: also released when live mode is stopped, which clears liveRunning under
+// dataMutex before notifying, so checking it here under the same lock cannot miss the wakeup
+void livePauseCheck() {
+    std::unique_lock<std::mutex> lock(dataMutex);
+    if (stepMode) {
+        if (liveRunning) stepCV.wait(lock);
+    }
+    else {
+        pauseCV.wait(lock, [] { return !isPaused || !liveRunning; });
     }
 }
 
-void heapSortVisualized(std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
-    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
-    int n = static_cast<int>(data.size());
-    for (int i = n / 2 - 1; i >= 0 && !isAborted; --i)
-        heapify(data, n, i, delay, highlightedIndices, comparisons, swaps);
-    for (int i = n - 1; i > 0 && !isAborted; --i) {
+// GUI live mode: a producer thread queues updates at `rate` per second, this thread drains them in
+// batches of up to batchSize, keeps `data` sorted and records the queue-to-visible latency per batch.
+// Inserted values are at most maxValue, captured by the GUI thread since WINDOW_HEIGHT changes on resize.
+void liveUpdatesVisualized(std::vector<int>& data, float rate, int batchSize, int maxValue,
+    std::vector<int>& highlightedIndices, LiveStats& stats, std::atomic<bool>& sorting) {
+    LiveSortedStore store;
+    {
+        std::lock_guard<std::mutex> lock(dataMutex);
+        std::sort(data.begin(), data.end());
+        store.flat = data;
+    }
+
+    std::mutex queueMutex;
+    std::condition_variable queueCV;
+    std::vector<LiveUpdate> queue;
+    std::vector<int> live = store.flat;
+    std::thread producer([&, live, maxValue]() mutable {
+        std::random_device rd;
+        std::mt19937 g(rd());
+        auto interval = std::chrono::duration<float>(1.0f / rate);
+        while (liveRunning && !isAborted) {
+            LiveUpdate update = nextLiveUpdate(live, g, 10, 200, 50, maxValue);
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                queue.push_back(update);
+            }
+            queueCV.notify_one();
+            std::this_thread::sleep_for(interval);
+        }
+    });
+
+    std::vector<LiveUpdate> batch;
+    std::vector<double> latencies;
+    while (liveRunning && !isAborted) {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCV.wait_for(lock, std::chrono::milliseconds(100),
+                [&] { return static_cast<int>(queue.size()) >= batchSize || !liveRunning || isAborted; });
+            size_t take = std::min(queue.size(), static_cast<size_t>(batchSize));
+            batch.assign(queue.begin(), queue.begin() + take);
+            queue.erase(queue.begin(), queue.begin() + take);
+        }
+        if (batch.empty()) continue;
+
+        liveApplyBatch(store, batch, LiveStrategy::Adaptive);
+        const std::vector<int>& view = liveSortedView(store);
         {
+            // Stop and Abort clear liveRunning under this lock, so nothing is written after they return
             std::lock_guard<std::mutex> lock(dataMutex);
-            std::swap(data[0], data[i]);
-            swaps++;
-            highlightedIndices = { 0, i };
+            if (!liveRunning || isAborted) break;
+            data = view;
+            highlightedIndices.clear();
+            for (int v : store.inserts)
+                highlightedIndices.push_back(static_cast<int>(std::lower_bound(data.begin(), data.end(), v) - data.begin()));
         }
-        pauseCheck();
-        std::this_thread::sleep_for(std::chrono::duration<float>(delay));
-        heapify(data, i, 0, delay, highlightedIndices, comparisons, swaps);
+
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - batch.front().queuedAt).count();
+        latencies.push_back(ms);
+        if (latencies.size() > 1000) latencies.erase(latencies.begin());
+        stats.applied += batch.size();
+        stats.p99Ms = percentile(latencies, 0.99);
+        livePauseCheck();
     }
+    producer.join();
+
     if (!isAborted) {
         std::lock_guard<std::mutex> lock(dataMutex);
         sorting = false;
@@ -287,7 +1511,506 @@ void heapSortVisualized(std::vector<int>& data, float delay, std::vector<int>& h
     }
 }
 
-int main() {
+// Headless benchmark (run with --benchmark [n]): every engine sorts the same random input with zero delay,
+// so the numbers include the visualization bookkeeping (mutex, highlight updates) but no sleeping.
+typedef void (*SortEngine)(std::vector<int>&, float, std::vector<int>&,
+    std::atomic<size_t>&, std::atomic<size_t>&, std::atomic<bool>&);
+
+void mergeSortEngine(std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    mergeSort(data, 0, static_cast<int>(data.size()) - 1, delay, highlightedIndices, comparisons, swaps, sorting);
+}
+
+void quickSortEngine(std::vector<int>& data, float delay, std::vector<int>& highlightedIndices,
+    std::atomic<size_t>& comparisons, std::atomic<size_t>& swaps, std::atomic<bool>& sorting) {
+    quickSort(data, 0, static_cast<int>(data.size()) - 1, delay, highlightedIndices, comparisons, swaps, sorting);
+}
+
+#ifdef __linux__
+const uint32_t PERF_TYPE_HW_CACHE_ID = PERF_TYPE_HW_CACHE;
+const uint64_t L1D_READ_MISS_CONFIG = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+const uint32_t PERF_TYPE_HARDWARE_ID = PERF_TYPE_HARDWARE;
+const uint64_t LLC_MISS_CONFIG = PERF_COUNT_HW_CACHE_MISSES;
+#else
+const uint32_t PERF_TYPE_HW_CACHE_ID = 0;
+const uint64_t L1D_READ_MISS_CONFIG = 0;
+const uint32_t PERF_TYPE_HARDWARE_ID = 0;
+const uint64_t LLC_MISS_CONFIG = 0;
+#endif
+
+// Hardware cache-miss counter for the calling thread (Linux perf events, user space only).
+// Returns -1 on other platforms, or where the kernel or the VM does not expose the PMU.
+int openPerfCounter(uint32_t type, uint64_t config) {
+#ifdef __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+    (void)type;
+    (void)config;
+    return -1;
+#endif
+}
+
+void startPerfCounter(int fd) {
+#ifdef __linux__
+    if (fd < 0) return;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#else
+    (void)fd;
+#endif
+}
+
+// Count since startPerfCounter, as text so an unavailable counter prints "n/a"
+std::string stopPerfCounter(int fd) {
+#ifdef __linux__
+    long long count = 0;
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count))) return std::to_string(count);
+    }
+#else
+    (void)fd;
+#endif
+    return "n/a";
+}
+
+void closePerfCounter(int fd) {
+#ifdef __linux__
+    if (fd >= 0) close(fd);
+#else
+    (void)fd;
+#endif
+}
+
+// Cache profile per engine: "Lines" is the portable count of child cache lines the heap sifts read
+// (cacheLinesTouched, 0 for the non-heap engines); L1D and LLC misses come from perf where available
+// and, unlike the wall time, are dominated by the data accesses rather than the per-step bookkeeping.
+void runBenchmark(int n) {
+    struct Entry { const char* name; SortEngine engine; };
+    const Entry entries[] = {
+        { "Merge Sort", mergeSortEngine },
+        { "Quick Sort", quickSortEngine },
+        { "Heap Sort", heapSortVisualized },
+        { "Bottom-Up Heap", heapSortBottomUpVisualized },
+        { "4-ary Heap", heapSortDAryVisualized },
+        { "Prefetch Heap", heapSortPrefetchVisualized },
+    };
+
+    // Wide value range so the Lomuto partition in quickSort does not degrade on duplicates
+    std::mt19937 g(12345);
+    std::vector<int> input(n);
+    for (int& v : input) v = std::uniform_int_distribution<>(0, 1 << 30)(g);
+
+    int l1dMisses = openPerfCounter(PERF_TYPE_HW_CACHE_ID, L1D_READ_MISS_CONFIG);
+    int llcMisses = openPerfCounter(PERF_TYPE_HARDWARE_ID, LLC_MISS_CONFIG);
+
+    std::cout << "n = " << n << "\n";
+    std::cout << std::left << std::setw(18) << "Engine" << std::right << std::setw(14) << "Comparisons"
+        << std::setw(14) << "Swaps" << std::setw(12) << "Lines" << std::setw(14) << "L1D misses"
+        << std::setw(14) << "LLC misses" << std::setw(12) << "Time (ms)" << "  Sorted\n";
+    for (const Entry& entry : entries) {
+        std::vector<int> data = input;
+        std::vector<int> highlightedIndices;
+        std::atomic<size_t> comparisons(0);
+        std::atomic<size_t> swaps(0);
+        std::atomic<bool> sorting(true);
+        cacheLinesTouched = 0;
+
+        startPerfCounter(l1dMisses);
+        startPerfCounter(llcMisses);
+        auto start = std::chrono::steady_clock::now();
+        entry.engine(data, 0.0f, highlightedIndices, comparisons, swaps, sorting);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::string l1d = stopPerfCounter(l1dMisses);
+        std::string llc = stopPerfCounter(llcMisses);
+
+        std::cout << std::left << std::setw(18) << entry.name << std::right << std::setw(14) << comparisons
+            << std::setw(14) << swaps << std::setw(12) << cacheLinesTouched << std::setw(14) << l1d
+            << std::setw(14) << llc << std::setw(12) << std::fixed << std::setprecision(1) << ms
+            << "  " << (std::is_sorted(data.begin(), data.end()) ? "yes" : "NO") << "\n";
+    }
+    closePerfCounter(l1dMisses);
+    closePerfCounter(llcMisses);
+}
+
+// Plain insertion sort, the usual small-n base case the networks compete with
+void insertionSortRange(int* v, int n) {
+    for (int i = 1; i < n; ++i) {
+        int key = v[i];
+        int j = i - 1;
+        while (j >= 0 && v[j] > key) {
+            v[j + 1] = v[j];
+            j--;
+        }
+        v[j + 1] = key;
+    }
+}
+
+// Uninstrumented networks against insertion sort on `arrays` independent random arrays of each size,
+// as a merge or quick leaf would see them; the isolated suggestion is the largest size at which the
+// network still wins. Then Merge Sort and Quick Sort are timed end to end at each cutoff, which also
+// prices the recursion and partition work a larger leaf saves, and the fastest total is suggested.
+void runNetworkBenchmark(int arrays) {
+    std::mt19937 g(12345);
+    std::cout << "arrays per size = " << arrays << "\n";
+    std::cout << std::right << std::setw(4) << "N" << std::setw(13) << "Comparators" << std::setw(16) << "Network (ns)"
+        << std::setw(18) << "Insertion (ns)" << "  Faster\n";
+    int cutoff = 1;
+    for (int n = 2; n <= MAX_NETWORK_SIZE; ++n) {
+        std::vector<int> input(static_cast<size_t>(n) * arrays);
+        for (int& v : input) v = std::uniform_int_distribution<>(0, 1 << 30)(g);
+
+        std::vector<int> data = input;
+        auto start = std::chrono::steady_clock::now();
+        NetworkSorter sorter = NETWORK_SORTERS[n];
+        size_t exchanges = 0;
+        for (int a = 0; a < arrays; ++a) sorter(&data[static_cast<size_t>(a) * n], exchanges);
+        double networkNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / arrays;
+        bool sorted = true;
+        for (int a = 0; a < arrays; ++a)
+            sorted = sorted && std::is_sorted(data.begin() + static_cast<size_t>(a) * n, data.begin() + static_cast<size_t>(a + 1) * n);
+
+        data = input;
+        start = std::chrono::steady_clock::now();
+        for (int a = 0; a < arrays; ++a) insertionSortRange(&data[static_cast<size_t>(a) * n], n);
+        double insertionNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / arrays;
+
+        if (networkNs < insertionNs) cutoff = n;
+        std::cout << std::setw(4) << n << std::setw(13) << NETWORKS[n].size << std::setw(16) << std::fixed
+            << std::setprecision(1) << networkNs << std::setw(18) << insertionNs << "  "
+            << (!sorted ? "NETWORK FAILED" : networkNs < insertionNs ? "network" : "insertion") << "\n";
+    }
+    std::cout << "Suggested --network-cutoff " << cutoff << " for isolated leaves\n";
+
+    // The leaf in context: Merge Sort and Quick Sort end to end (unrolled network leaves) at each
+    // cutoff, best of five runs to damp scheduler noise
+    const int n = 100000;
+    std::vector<int> input(n);
+    for (int& v : input) v = std::uniform_int_distribution<>(0, 1 << 30)(g);
+    std::cout << "\nn = " << n << "\n" << std::setw(6) << "Cutoff" << std::setw(16) << "Merge (ms)"
+        << std::setw(16) << "Quick (ms)" << "\n";
+    int current = NETWORK_CUTOFF;
+    int bestCutoff = current;
+    double bestMs = 0.0;
+    for (int c = 1; c <= MAX_NETWORK_SIZE; c += (c < 4 ? 1 : 2)) {
+        NETWORK_CUTOFF = c;
+        double ms[2];
+        SortEngine engines[2] = { mergeSortEngine, quickSortEngine };
+        for (int e = 0; e < 2; ++e) {
+            for (int run = 0; run < 5; ++run) {
+                std::vector<int> data = input;
+                std::vector<int> highlightedIndices;
+                std::atomic<size_t> comparisons(0);
+                std::atomic<size_t> swaps(0);
+                std::atomic<bool> sorting(true);
+                auto start = std::chrono::steady_clock::now();
+                engines[e](data, 0.0f, highlightedIndices, comparisons, swaps, sorting);
+                double runMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                ms[e] = run == 0 ? runMs : std::min(ms[e], runMs);
+            }
+        }
+        if (c == 1 || ms[0] + ms[1] < bestMs) {
+            bestMs = ms[0] + ms[1];
+            bestCutoff = c;
+        }
+        std::cout << std::setw(6) << c << std::setw(16) << std::fixed << std::setprecision(1) << ms[0]
+            << std::setw(16) << ms[1] << "\n";
+    }
+    NETWORK_CUTOFF = current;
+    std::cout << "Suggested --network-cutoff " << bestCutoff << " for the engines (current " << NETWORK_CUTOFF << ")\n";
+}
+
+typedef void (*SelectEngine)(std::vector<int>&, int, float, std::vector<int>&,
+    std::atomic<size_t>&, std::atomic<size_t>&, std::atomic<bool>&);
+
+// Selection engines on the given values with the k-th smallest as target. The streaming top-k row reads the
+// input once through a (k + 1)-slot buffer, as it would from a file or socket, instead of owning the array.
+void runSelectBenchmark(const std::vector<int>& input, int k) {
+    struct Entry { const char* name; SelectEngine engine; bool partialSort; };
+    const Entry entries[] = {
+        { "Introselect", introSelectVisualized, false },
+        { "Floyd-Rivest", floydRivestSelectVisualized, false },
+        { "Heap Partial", heapPartialSortVisualized, true },
+        { "QSelect Partial", quickSelectPartialSortVisualized, true },
+    };
+
+    int n = static_cast<int>(input.size());
+    std::vector<int> expected = input;
+    std::sort(expected.begin(), expected.end());
+
+    auto printRow = [](const char* name, size_t comparisons, size_t swaps, double ms, bool correct) {
+        std::cout << std::left << std::setw(18) << name << std::right << std::setw(14) << comparisons
+            << std::setw(14) << swaps << std::setw(12) << std::fixed << std::setprecision(1) << ms
+            << "  " << (correct ? "yes" : "NO") << "\n";
+    };
+
+    std::cout << "n = " << n << ", k = " << k << "\n";
+    std::cout << std::left << std::setw(18) << "Engine" << std::right << std::setw(14) << "Comparisons"
+        << std::setw(14) << "Swaps" << std::setw(12) << "Time (ms)" << "  Correct\n";
+    for (const Entry& entry : entries) {
+        std::vector<int> data = input;
+        std::vector<int> highlightedIndices;
+        std::atomic<size_t> comparisons(0);
+        std::atomic<size_t> swaps(0);
+        std::atomic<bool> sorting(true);
+
+        auto start = std::chrono::steady_clock::now();
+        entry.engine(data, k, 0.0f, highlightedIndices, comparisons, swaps, sorting);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        bool correct = entry.partialSort
+            ? std::equal(data.begin(), data.begin() + k, expected.begin())
+            : data[k - 1] == expected[k - 1]
+                && std::all_of(data.begin(), data.begin() + k, [&](int v) { return v <= data[k - 1]; })
+                && std::all_of(data.begin() + k, data.end(), [&](int v) { return v >= data[k - 1]; });
+        printRow(entry.name, comparisons, swaps, ms, correct);
+    }
+
+    {
+        std::vector<int> buffer(k + 1);
+        std::vector<int> highlightedIndices;
+        std::atomic<size_t> comparisons(0);
+        std::atomic<size_t> swaps(0);
+        int heapSize = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int value : input) {
+            int slot = heapSize < k ? heapSize : k;
+            buffer[slot] = value;
+            topKOffer(buffer, heapSize, k, slot, 0.0f, highlightedIndices, comparisons, swaps);
+        }
+        sortDownHeap(buffer, 0, heapSize, 0.0f, highlightedIndices, swaps,
+            [&](int size, int root) { heapify(buffer, size, root, 0.0f, highlightedIndices, comparisons, swaps); });
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        printRow("Streaming Top-K", comparisons, swaps, ms, std::equal(buffer.begin(), buffer.begin() + k, expected.begin()));
+    }
+
+    std::vector<int> data = input;
+    auto start = std::chrono::steady_clock::now();
+    std::nth_element(data.begin(), data.begin() + (k - 1), data.end());
+    double nthMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    data = input;
+    start = std::chrono::steady_clock::now();
+    std::partial_sort(data.begin(), data.begin() + k, data.end());
+    double partialMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::left << std::setw(18) << "std::nth_element" << std::right << std::setw(40) << std::fixed
+        << std::setprecision(1) << nthMs << "\n";
+    std::cout << std::left << std::setw(18) << "std::partial_sort" << std::right << std::setw(40) << std::fixed
+        << std::setprecision(1) << partialMs << "\n";
+}
+
+// Runs every engine on uniform values and on a low-cardinality input (values 0..3), where duplicate-heavy
+// partitions would make an unguarded quickselect quadratic.
+void runSelectBenchmark(int n, int k) {
+    std::mt19937 g(12345);
+    std::vector<int> input(n);
+    for (int& v : input) v = std::uniform_int_distribution<>(0, 1 << 30)(g);
+    std::cout << "Uniform values\n";
+    runSelectBenchmark(input, k);
+    for (int& v : input) v = std::uniform_int_distribution<>(0, 3)(g);
+    std::cout << "\nValues 0..3\n";
+    runSelectBenchmark(input, k);
+}
+
+// Steady-state cost of keeping n values sorted under a stream of updates. Updates are generated
+// synchronously, so the latencies are pure apply time per batch, without producer pacing or queueing.
+// The first batch (which may convert the representation) is not timed, and each run stops after
+// `updates` updates or LIVE_BENCHMARK_BUDGET_MS of apply time, whichever comes first.
+const double LIVE_BENCHMARK_BUDGET_MS = 2000.0;
+
+void runLiveBenchmark(int n, int updates) {
+    struct Entry { const char* name; LiveStrategy strategy; };
+    const Entry entries[] = {
+        { "Merge", LiveStrategy::Merge },
+        { "Blocked", LiveStrategy::Blocked },
+        { "Adaptive", LiveStrategy::Adaptive },
+    };
+    const int batchSizes[] = { 1, 8, 64, 512, 4096 };
+
+    std::cout << "n = " << n << ", updates per run = " << updates << "\n";
+    std::cout << std::left << std::setw(12) << "Strategy" << std::right << std::setw(8) << "Batch"
+        << std::setw(14) << "Updates/s" << std::setw(12) << "p50 (us)" << std::setw(12) << "p99 (us)"
+        << std::setw(12) << "max (us)" << "  Sorted\n";
+    for (const Entry& entry : entries) {
+        for (int batchSize : batchSizes) {
+            std::mt19937 g(12345);
+            LiveSortedStore store;
+            store.flat.resize(n);
+            for (int& v : store.flat) v = std::uniform_int_distribution<>(0, 1 << 30)(g);
+            std::sort(store.flat.begin(), store.flat.end());
+            std::vector<int> live = store.flat;
+
+            std::vector<LiveUpdate> batch;
+            std::vector<double> latencies;
+            double totalUs = 0.0;
+            for (int done = -batchSize; done < updates && totalUs < LIVE_BENCHMARK_BUDGET_MS * 1000.0; done += batchSize) {
+                batch.clear();
+                for (int i = 0; i < batchSize; ++i)
+                    batch.push_back(nextLiveUpdate(live, g, n / 2, n * 2, 0, 1 << 30));
+
+                auto start = std::chrono::steady_clock::now();
+                liveApplyBatch(store, batch, entry.strategy);
+                double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+                if (done < 0) continue;
+                latencies.push_back(us);
+                totalUs += us;
+            }
+
+            const std::vector<int>& view = liveSortedView(store);
+            std::sort(live.begin(), live.end());
+            bool correct = view == live;
+            double throughput = totalUs > 0.0 ? latencies.size() * batchSize / (totalUs / 1e6) : 0.0;
+            std::cout << std::left << std::setw(12) << entry.name << std::right << std::setw(8) << batchSize
+                << std::setw(14) << std::fixed << std::setprecision(0) << throughput
+                << std::setw(12) << std::setprecision(1) << percentile(latencies, 0.5)
+                << std::setw(12) << percentile(latencies, 0.99)
+                << std::setw(12) << *std::max_element(latencies.begin(), latencies.end())
+                << "  " << (correct ? "yes" : "NO") << "\n";
+        }
+    }
+}
+
+typedef void (*StringSortEngine)(StringArena&, std::vector<int>&, float, std::vector<int>&,
+    std::atomic<size_t>&, std::atomic<size_t>&, std::atomic<bool>&);
+
+// String engines count byte inspections as comparisons and StringRef moves as swaps. The baseline is
+// std::sort over individually allocated std::string objects, i.e. what the arena is meant to replace.
+void runStringBenchmark(const StringArena& source) {
+    struct Entry { const char* name; StringSortEngine engine; };
+    const Entry entries[] = {
+        { "Multikey QS", multikeyQuickSortVisualized },
+        { "MSD Radix", msdRadixSortVisualized },
+        { "LCP Merge", lcpMergeSortVisualized },
+    };
+
+    // Self-check on keys the random generator never produces: embedded and shared NUL bytes, empty keys,
+    // a run of identical keys longer than MSD_CUTOFF that starts with a NUL, and a run that shares a NUL
+    // at byte 1 but differs after it
+    StringArena edge;
+    const std::string edgeKeys[] = { std::string("a\0b", 3), std::string("\0", 1), "", std::string("\0\0", 2), "a",
+        std::string("\0x", 2), "b", std::string("a\0", 2) };
+    for (const std::string& key : edgeKeys) appendString(edge, key.data(), key.size());
+    for (int i = 0; i < 40; ++i) appendString(edge, "\0xy", 3);
+    for (int i = 0; i < 40; ++i) {
+        const char key[] = { 'z', '\0', static_cast<char>('a' + i % 26) };
+        appendString(edge, key, 3);
+    }
+    std::shuffle(edge.keys.begin(), edge.keys.end(), std::mt19937(1));
+    // and keys sharing a prefix far longer than any stack could afford one frame per byte for
+    StringArena longPrefix;
+    for (int i = 0; i < 50; ++i) {
+        std::string key(200000, 'p');
+        key += static_cast<char>('a' + (i * 7) % 26);
+        key += static_cast<char>('a' + i % 5);
+        appendString(longPrefix, key.data(), key.size());
+    }
+    for (const Entry& entry : entries) {
+        StringArena arena = edge;
+        std::vector<int> data(arena.keys.size());
+        std::vector<int> highlightedIndices;
+        std::atomic<size_t> comparisons(0);
+        std::atomic<size_t> swaps(0);
+        std::atomic<bool> sorting(true);
+        entry.engine(arena, data, 0.0f, highlightedIndices, comparisons, swaps, sorting);
+        bool sorted = std::is_sorted(arena.keys.begin(), arena.keys.end(),
+            [&](const StringRef& a, const StringRef& b) { return stringLess(arena, a, b); });
+        std::cout << "Self-check (NUL keys) " << entry.name << ": " << (sorted ? "ok" : "FAILED") << "\n";
+
+        arena = longPrefix;
+        data.assign(arena.keys.size(), 0);
+        entry.engine(arena, data, 0.0f, highlightedIndices, comparisons, swaps, sorting);
+        sorted = std::is_sorted(arena.keys.begin(), arena.keys.end(),
+            [&](const StringRef& a, const StringRef& b) { return stringLess(arena, a, b); });
+        std::cout << "Self-check (200000-byte shared prefix) " << entry.name << ": " << (sorted ? "ok" : "FAILED") << "\n";
+    }
+
+    std::cout << "strings = " << source.keys.size() << ", bytes = " << source.bytes.size() << "\n";
+    std::cout << std::left << std::setw(18) << "Engine" << std::right << std::setw(14) << "Byte reads"
+        << std::setw(14) << "Moves" << std::setw(12) << "Time (ms)" << "  Sorted\n";
+    for (const Entry& entry : entries) {
+        StringArena arena = source;
+        std::vector<int> data(arena.keys.size());
+        std::vector<int> highlightedIndices;
+        std::atomic<size_t> comparisons(0);
+        std::atomic<size_t> swaps(0);
+        std::atomic<bool> sorting(true);
+
+        auto start = std::chrono::steady_clock::now();
+        entry.engine(arena, data, 0.0f, highlightedIndices, comparisons, swaps, sorting);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        bool sorted = std::is_sorted(arena.keys.begin(), arena.keys.end(),
+            [&](const StringRef& a, const StringRef& b) { return stringLess(arena, a, b); });
+        std::cout << std::left << std::setw(18) << entry.name << std::right << std::setw(14) << comparisons
+            << std::setw(14) << swaps << std::setw(12) << std::fixed << std::setprecision(1) << ms
+            << "  " << (sorted ? "yes" : "NO") << "\n";
+    }
+
+    std::vector<std::string> strings;
+    strings.reserve(source.keys.size());
+    for (const StringRef& ref : source.keys)
+        strings.emplace_back(source.bytes.data() + ref.offset, ref.length);
+    auto start = std::chrono::steady_clock::now();
+    std::sort(strings.begin(), strings.end());
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::left << std::setw(18) << "std::sort<string>" << std::right << std::setw(14) << "-"
+        << std::setw(14) << "-" << std::setw(12) << std::fixed << std::setprecision(1) << ms << "  yes\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 2 && std::string(argv[1]) == "--network-cutoff") {
+        NETWORK_CUTOFF = std::max(1, std::min(std::stoi(argv[2]), MAX_NETWORK_SIZE));
+        argv[2] = argv[0];
+        argv += 2;
+        argc -= 2;
+    }
+    if (argc > 1 && std::string(argv[1]).compare(0, 11, "--benchmark") == 0) UNROLLED_LEAVES = true;
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-networks") {
+        runNetworkBenchmark(argc > 2 ? std::stoi(argv[2]) : 100000);
+        return 0;
+    }
+    if (argc > 1 && std::string(argv[1]) == "--benchmark") {
+        runBenchmark(argc > 2 ? std::stoi(argv[2]) : 100000);
+        return 0;
+    }
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-select") {
+        int n = argc > 2 ? std::stoi(argv[2]) : 1000000;
+        int k = argc > 3 ? std::stoi(argv[3]) : 1000;
+        runSelectBenchmark(n, std::max(1, std::min(k, n)));
+        return 0;
+    }
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-live") {
+        int n = argc > 2 ? std::stoi(argv[2]) : 1000000;
+        int updates = argc > 3 ? std::stoi(argv[3]) : 100000;
+        runLiveBenchmark(std::max(1, n), std::max(1, updates));
+        return 0;
+    }
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-strings") {
+        StringArena arena;
+        generateStrings(arena, argc > 2 ? std::stoi(argv[2]) : 100000, argc > 3 ? std::stoi(argv[3]) : 8);
+        runStringBenchmark(arena);
+        return 0;
+    }
+    if (argc > 2 && std::string(argv[1]) == "--benchmark-strings-file") {
+        StringArena arena;
+        std::string error;
+        if (!loadStrings(arena, argv[2], error)) {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+        runStringBenchmark(arena);
+        return 0;
+    }
+
     try {
         sf::RenderWindow window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Sorting Visualizer (TGUI)", sf::Style::Resize | sf::Style::Close);
         window.setFramerateLimit(60);
@@ -300,33 +2023,69 @@ int main() {
         auto mergeBtn = tgui::Button::create("Merge Sort");
         auto quickBtn = tgui::Button::create("Quick Sort");
         auto heapBtn = tgui::Button::create("Heap Sort");
+        auto bottomUpHeapBtn = tgui::Button::create("Bottom-Up Heap");
+        auto dAryHeapBtn = tgui::Button::create("4-ary Heap");
+        auto prefetchHeapBtn = tgui::Button::create("Prefetch Heap");
+        auto multikeyBtn = tgui::Button::create("Multikey QS");
+        auto msdRadixBtn = tgui::Button::create("MSD Radix");
+        auto lcpMergeBtn = tgui::Button::create("LCP Merge");
+        auto introSelectBtn = tgui::Button::create("Introselect");
+        auto floydRivestBtn = tgui::Button::create("Floyd-Rivest");
+        auto heapPartialBtn = tgui::Button::create("Heap Partial");
+        auto quickPartialBtn = tgui::Button::create("QSelect Partial");
+        auto topKBtn = tgui::Button::create("Streaming Top-K");
         auto shuffleBtn = tgui::Button::create("Reshuffle");
         auto pauseBtn = tgui::Button::create("Pause");
         auto abortBtn = tgui::Button::create("Abort");
         auto stepBtn = tgui::Button::create("Step Mode");
         auto stepNextBtn = tgui::Button::create("Step");
+        auto liveBtn = tgui::Button::create("Live Updates");
 
         bubbleBtn->setPosition(20, 20);
         insertBtn->setPosition(150, 20);
         mergeBtn->setPosition(280, 20);
         quickBtn->setPosition(410, 20);
         heapBtn->setPosition(540, 20);
+        bottomUpHeapBtn->setPosition(280, 120);
+        dAryHeapBtn->setPosition(410, 120);
+        prefetchHeapBtn->setPosition(540, 120);
+        multikeyBtn->setPosition(280, 170);
+        msdRadixBtn->setPosition(410, 170);
+        lcpMergeBtn->setPosition(540, 170);
+        introSelectBtn->setPosition(280, 220);
+        floydRivestBtn->setPosition(410, 220);
+        heapPartialBtn->setPosition(540, 220);
+        quickPartialBtn->setPosition(670, 220);
+        topKBtn->setPosition(800, 220);
         shuffleBtn->setPosition(670, 20);
         pauseBtn->setPosition(20, 70);
         abortBtn->setPosition(150, 70);
         stepBtn->setPosition(280, 70);
         stepNextBtn->setPosition(410, 70);
+        liveBtn->setPosition(540, 70);
 
         bubbleBtn->setSize({ 120, 40 });
         insertBtn->setSize({ 120, 40 });
         mergeBtn->setSize({ 120, 40 });
         quickBtn->setSize({ 120, 40 });
         heapBtn->setSize({ 120, 40 });
+        bottomUpHeapBtn->setSize({ 120, 40 });
+        dAryHeapBtn->setSize({ 120, 40 });
+        prefetchHeapBtn->setSize({ 120, 40 });
+        multikeyBtn->setSize({ 120, 40 });
+        msdRadixBtn->setSize({ 120, 40 });
+        lcpMergeBtn->setSize({ 120, 40 });
+        introSelectBtn->setSize({ 120, 40 });
+        floydRivestBtn->setSize({ 120, 40 });
+        heapPartialBtn->setSize({ 120, 40 });
+        quickPartialBtn->setSize({ 120, 40 });
+        topKBtn->setSize({ 120, 40 });
         shuffleBtn->setSize({ 120, 40 });
         pauseBtn->setSize({ 120, 40 });
         abortBtn->setSize({ 120, 40 });
         stepBtn->setSize({ 120, 40 });
         stepNextBtn->setSize({ 120, 40 });
+        liveBtn->setSize({ 120, 40 });
 
         auto speedSlider = tgui::Slider::create(0, 100);
         speedSlider->setValue(50);
@@ -342,6 +2101,26 @@ int main() {
         countSlider->setPosition(670, 100);
         countSlider->setSize({ 120, 20 });
 
+        // Length of the prefix shared by every generated string key
+        auto prefixSlider = tgui::Slider::create(0, 20);
+        prefixSlider->setValue(4);
+        prefixSlider->setPosition(810, 70);
+        prefixSlider->setSize({ 120, 20 });
+
+        auto prefixLabel = tgui::Label::create("Prefix: 4");
+        prefixLabel->setPosition(810, 100);
+        prefixLabel->setTextSize(16);
+
+        // k for the selection engines: the k-th smallest for nth_element, the k smallest for the partial sorts
+        auto kSlider = tgui::Slider::create(1, 200);
+        kSlider->setValue(10);
+        kSlider->setPosition(810, 130);
+        kSlider->setSize({ 120, 20 });
+
+        auto kLabel = tgui::Label::create("K: 10");
+        kLabel->setPosition(810, 160);
+        kLabel->setTextSize(16);
+
         auto statusLabel = tgui::Label::create("Idle");
         statusLabel->setPosition(20, 120);
         statusLabel->setTextSize(16);
@@ -358,23 +2137,49 @@ int main() {
         timeLabel->setPosition(20, 210);
         timeLabel->setTextSize(16);
 
+        auto depthLabel = tgui::Label::create("Depth: 0");
+        depthLabel->setPosition(20, 240);
+        depthLabel->setTextSize(16);
+
+        auto liveLabel = tgui::Label::create("Live: off");
+        liveLabel->setPosition(20, 270);
+        liveLabel->setTextSize(16);
+
         gui.add(bubbleBtn);
         gui.add(insertBtn);
         gui.add(mergeBtn);
         gui.add(quickBtn);
         gui.add(heapBtn);
+        gui.add(bottomUpHeapBtn);
+        gui.add(dAryHeapBtn);
+        gui.add(prefetchHeapBtn);
+        gui.add(multikeyBtn);
+        gui.add(msdRadixBtn);
+        gui.add(lcpMergeBtn);
+        gui.add(introSelectBtn);
+        gui.add(floydRivestBtn);
+        gui.add(heapPartialBtn);
+        gui.add(quickPartialBtn);
+        gui.add(topKBtn);
         gui.add(shuffleBtn);
         gui.add(pauseBtn);
         gui.add(abortBtn);
         gui.add(stepBtn);
         gui.add(stepNextBtn);
+        gui.add(liveBtn);
         gui.add(speedSlider);
         gui.add(speedLabel);
         gui.add(countSlider);
+        gui.add(prefixSlider);
+        gui.add(prefixLabel);
+        gui.add(kSlider);
+        gui.add(kLabel);
         gui.add(statusLabel);
         gui.add(comparisonLabel);
         gui.add(swapLabel);
         gui.add(timeLabel);
+        gui.add(depthLabel);
+        gui.add(liveLabel);
 
         // Font for FPS and Enrollment Number
         sf::Font font;
@@ -402,6 +2207,7 @@ int main() {
         std::vector<int> data(NUM_BARS);
         std::vector<int> renderData(NUM_BARS);
         std::vector<int> highlightedIndices;
+        StringArena stringArena;
         shuffleData(data);
         {
             std::lock_guard<std::mutex> lock(dataMutex);
@@ -410,6 +2216,7 @@ int main() {
         std::atomic<bool> sorting(false);
         std::atomic<size_t> comparisons(0);
         std::atomic<size_t> swaps(0);
+        LiveStats liveStats;
         std::function<void()> sortFunc = nullptr;
         std::thread sortThread;
         sf::Clock sortClock;
@@ -434,11 +2241,24 @@ int main() {
             mergeBtn->setEnabled(true);
             quickBtn->setEnabled(true);
             heapBtn->setEnabled(true);
+            bottomUpHeapBtn->setEnabled(true);
+            dAryHeapBtn->setEnabled(true);
+            prefetchHeapBtn->setEnabled(true);
+            multikeyBtn->setEnabled(true);
+            msdRadixBtn->setEnabled(true);
+            lcpMergeBtn->setEnabled(true);
+            introSelectBtn->setEnabled(true);
+            floydRivestBtn->setEnabled(true);
+            heapPartialBtn->setEnabled(true);
+            quickPartialBtn->setEnabled(true);
+            topKBtn->setEnabled(true);
             shuffleBtn->setEnabled(true);
             pauseBtn->setEnabled(!stepMode);
             abortBtn->setEnabled(true);
             stepBtn->setEnabled(true);
             stepNextBtn->setEnabled(stepMode && sorting);
+            liveBtn->setEnabled(true);
+            liveBtn->setText("Live Updates");
             };
 
         auto disableButtons = [&] {
@@ -447,11 +2267,23 @@ int main() {
             mergeBtn->setEnabled(false);
             quickBtn->setEnabled(false);
             heapBtn->setEnabled(false);
+            bottomUpHeapBtn->setEnabled(false);
+            dAryHeapBtn->setEnabled(false);
+            prefetchHeapBtn->setEnabled(false);
+            multikeyBtn->setEnabled(false);
+            msdRadixBtn->setEnabled(false);
+            lcpMergeBtn->setEnabled(false);
+            introSelectBtn->setEnabled(false);
+            floydRivestBtn->setEnabled(false);
+            heapPartialBtn->setEnabled(false);
+            quickPartialBtn->setEnabled(false);
+            topKBtn->setEnabled(false);
             shuffleBtn->setEnabled(false);
             pauseBtn->setEnabled(!stepMode);
             abortBtn->setEnabled(true);
             stepBtn->setEnabled(false);
             stepNextBtn->setEnabled(stepMode && sorting);
+            liveBtn->setEnabled(liveRunning);
             };
 
         auto resetCounters = [&] {
@@ -464,21 +2296,106 @@ int main() {
             comparisonLabel->setText("Comparisons: 0");
             swapLabel->setText("Swaps: 0");
             timeLabel->setText("Time: 0.0s");
+            charDepth = 0;
+            depthLabel->setText("Depth: 0");
             };
 
+        // Under dataMutex: an aborted worker (sort threads are detached) may still be finishing a step,
+        // and a live worker replaces `data` with an array of a different size
         auto regenerate = [&] {
             NUM_BARS = static_cast<int>(countSlider->getValue());
-            BAR_WIDTH = static_cast<float>(WINDOW_WIDTH) / NUM_BARS;
+            std::lock_guard<std::mutex> lock(dataMutex);
             data.resize(NUM_BARS);
-            renderData.resize(NUM_BARS);
             shuffleData(data);
+            renderData = data;
+            highlightedIndices.clear();
+            };
+
+        // Clears liveRunning under dataMutex (see livePauseCheck) and wakes a paused or stepping live worker
+        auto stopLive = [&] {
+            {
+                std::lock_guard<std::mutex> lock(dataMutex);
+                liveRunning = false;
+            }
+            pauseCV.notify_all();
+            stepCV.notify_all();
+            };
+
+        // Runs a sort on the sort thread with the usual status, timing and button handling around it
+        auto launchTask = [&](const std::string& name, std::function<void(float)> run) {
+            if (!sorting) {
+                sorting = true;
+                isAborted = false;
+                resetCounters();
+                statusLabel->setText(name + " Running");
+                sortClock.restart();
+                disableButtons();
+                sortFunc = [&, name, run] {
+                    run(BASE_DELAY / getSpeedMultiplier());
+                    if (!isAborted) {
+                        statusLabel->setText(name + " Complete");
+                        timeLabel->setText("Time: " + std::to_string(sortClock.getElapsedTime().asSeconds()) + "s");
+                        {
+                            std::lock_guard<std::mutex> lock(dataMutex);
+                            renderData = data;
+                        }
+                    }
+                    enableButtons();
+                    };
+                sortThread = std::thread(sortFunc);
+                sortThread.detach();
+            }
+            };
+
+        auto launchSort = [&](const std::string& name, SortEngine engine) {
+            launchTask(name, [&, engine](float delay) {
+                engine(data, delay, highlightedIndices, comparisons, swaps, sorting);
+                });
+            };
+
+        // Fresh string keys for the current bar count and prefix; each bar shows its key's final rank
+        auto launchStringSort = [&](const std::string& name, StringSortEngine engine) {
+            if (sorting) return;
+            generateStrings(stringArena, NUM_BARS, static_cast<int>(prefixSlider->getValue()));
             {
                 std::lock_guard<std::mutex> lock(dataMutex);
+                rankStringBars(stringArena, data);
                 renderData = data;
-                highlightedIndices.clear();
             }
+            launchTask(name, [&, engine](float delay) {
+                engine(stringArena, data, delay, highlightedIndices, comparisons, swaps, sorting);
+                });
+            };
+
+        auto launchSelect = [&](const std::string& name, SelectEngine engine) {
+            int k = std::max(1, std::min(static_cast<int>(kSlider->getValue()), static_cast<int>(data.size())));
+            launchTask(name, [&, engine, k](float delay) {
+                engine(data, k, delay, highlightedIndices, comparisons, swaps, sorting);
+                });
             };
 
+        // Live mode keeps the bars sorted while a producer streams updates at LIVE_BASE_RATE x speed per second;
+        // pressing the button again stops it
+        const float LIVE_BASE_RATE = 40.0f;
+        const int LIVE_GUI_BATCH = 8;
+        liveBtn->onPress([&] {
+            if (liveRunning) {
+                stopLive();
+                return;
+            }
+            if (sorting) return;
+            liveRunning = true;
+            liveStats.applied = 0;
+            liveStats.p99Ms = 0.0;
+            float rate = LIVE_BASE_RATE * getSpeedMultiplier();
+            int maxValue = WINDOW_HEIGHT - 100;
+            launchTask("Live Updates", [&, rate, maxValue](float) {
+                liveUpdatesVisualized(data, rate, LIVE_GUI_BATCH, maxValue, highlightedIndices, liveStats, sorting);
+                liveRunning = false;
+                });
+            liveBtn->setText("Stop Live");
+            });
+
         // Button Handlers (unchanged)
         bubbleBtn->onPress([&] {
             if (!sorting) {
@@ -610,6 +2527,18 @@ int main() {
             }
             });
 
+        bottomUpHeapBtn->onPress([&] { launchSort("Bottom-Up Heap Sort", heapSortBottomUpVisualized); });
+        dAryHeapBtn->onPress([&] { launchSort("4-ary Heap Sort", heapSortDAryVisualized); });
+        prefetchHeapBtn->onPress([&] { launchSort("Prefetch Heap Sort", heapSortPrefetchVisualized); });
+        multikeyBtn->onPress([&] { launchStringSort("Multikey Quicksort", multikeyQuickSortVisualized); });
+        msdRadixBtn->onPress([&] { launchStringSort("MSD Radix Sort", msdRadixSortVisualized); });
+        lcpMergeBtn->onPress([&] { launchStringSort("LCP Merge Sort", lcpMergeSortVisualized); });
+        introSelectBtn->onPress([&] { launchSelect("Introselect", introSelectVisualized); });
+        floydRivestBtn->onPress([&] { launchSelect("Floyd-Rivest Select", floydRivestSelectVisualized); });
+        heapPartialBtn->onPress([&] { launchSelect("Heap Partial Sort", heapPartialSortVisualized); });
+        quickPartialBtn->onPress([&] { launchSelect("Quickselect Partial Sort", quickSelectPartialSortVisualized); });
+        topKBtn->onPress([&] { launchSelect("Streaming Top-K", streamingTopKVisualized); });
+
         shuffleBtn->onPress([&] {
             if (!sorting) {
                 regenerate();
@@ -629,6 +2558,7 @@ int main() {
 
         abortBtn->onPress([&] {
             if (sorting) {
+                if (liveRunning) stopLive();
                 isAborted = true;
                 isPaused = false;
                 pauseCV.notify_all();
@@ -659,6 +2589,14 @@ int main() {
             }
             });
 
+        prefixSlider->onValueChange([&](float value) {
+            prefixLabel->setText("Prefix: " + std::to_string(static_cast<int>(value)));
+            });
+
+        kSlider->onValueChange([&](float value) {
+            kLabel->setText("K: " + std::to_string(static_cast<int>(value)));
+            });
+
         countSlider->onValueChange([&](float) {
             if (!sorting) {
                 regenerate();
@@ -680,7 +2618,6 @@ int main() {
                 if (event.type == sf::Event::Resized) {
                     WINDOW_WIDTH = event.size.width;
                     WINDOW_HEIGHT = event.size.height;
-                    BAR_WIDTH = static_cast<float>(WINDOW_WIDTH) / NUM_BARS;
                     window.setView(sf::View(sf::FloatRect(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT)));
                     fpsText.setPosition(10, WINDOW_HEIGHT - 25);
                     // Update enrollment text position
@@ -712,6 +2649,11 @@ int main() {
             // Update GUI elements
             comparisonLabel->setText("Comparisons: " + std::to_string(comparisons));
             swapLabel->setText("Swaps: " + std::to_string(swaps));
+            depthLabel->setText("Depth: " + std::to_string(charDepth));
+            if (liveRunning) {
+                liveLabel->setText("Live: " + std::to_string(liveStats.applied) + " updates, p99 "
+                    + std::to_string(liveStats.p99Ms.load()).substr(0, 5) + " ms");
+            }
             speedLabel->setText("Speed: " + std::to_string(getSpeedMultiplier()).substr(0, 4) + "x");
 
             // FPS Counter